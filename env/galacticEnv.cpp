@@ -0,0 +1,362 @@
+#include "galacticEnv.h"
+#include "gameRules.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+// Headless version of the update in Game / Player / Enemy / PowerUp.
+// The numbers come from gameRules.hpp, shared with the game.
+namespace {
+using namespace rules;
+
+constexpr float SCREEN_WIDTH  = static_cast<float>(PLAYFIELD_WIDTH);
+constexpr float SCREEN_HEIGHT = static_cast<float>(PLAYFIELD_HEIGHT);
+
+constexpr float PLAYER_W = PLAYER_WIDTH, PLAYER_H = PLAYER_HEIGHT;
+constexpr float BULLET_W = BULLET_WIDTH, BULLET_H = BULLET_HEIGHT;
+constexpr float ENEMY_W = ENEMY_WIDTH,   ENEMY_H = ENEMY_HEIGHT;
+constexpr float NUKE_W = NUKE_WIDTH,     NUKE_H = NUKE_HEIGHT;
+constexpr float SLOW_W = SLOW_WIDTH,     SLOW_H = SLOW_HEIGHT;
+
+static_assert(GD_OBS_ENEMIES >= MAX_ENEMIES, "every enemy needs an observation slot");
+constexpr int MAX_BULLETS = 8;   // cooldown and travel time allow at most 6 in flight
+constexpr int MAX_POWERUPS = 16; // spawns beyond this are dropped
+
+enum PowerUpType : int { NUKE = 1, SLOW = 2 };
+
+struct Body {
+    float x, y;
+    float velocity; // enemies keep the velocity they spawned with
+    int type;       // power-ups only
+};
+
+// Small fast generator; each environment owns one so results do not depend on batch order
+struct Rng {
+    std::uint64_t state;
+
+    std::uint64_t next() {
+        // splitmix64
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Inclusive range like randint() in game.cpp
+    int randint(int a, int b) {
+        return a + static_cast<int>(next() % static_cast<std::uint64_t>(b - a + 1));
+    }
+};
+
+// Same test as sf::FloatRect::intersects
+bool intersects(float ax, float ay, float aw, float ah, float bx, float by, float bw, float bh) {
+    return std::max(ax, bx) < std::min(ax + aw, bx + bw) &&
+           std::max(ay, by) < std::min(ay + ah, by + bh);
+}
+
+// Game::inView: nothing outside the visible playfield takes part in collisions
+bool inView(float x, float y, float w, float h) {
+    return intersects(x, y, w, h, 0.f, 0.f, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+// Remove element i keeping order, like the remove_if on Player::bullets
+void removeAt(Body *items, int &count, int i) {
+    for (int k = i + 1; k < count; ++k) items[k - 1] = items[k];
+    --count;
+}
+
+// Remove element i by moving the last one into its place, like SlotMap::eraseAt
+// on Game::enemies and Game::powerUps. Order matters for which enemy a bullet
+// hits first, so this must match the game.
+void swapRemoveAt(Body *items, int &count, int i) {
+    items[i] = items[count - 1];
+    --count;
+}
+
+struct Env {
+    Rng rng;
+
+    float time;
+    float lastShot;
+    float lastPowerUp;
+    int steps;
+
+    float playerX;
+    int lives, score, nukeCount, slowCount;
+    int level, waveLength;
+    float enemyVelocity;
+
+    Body enemies[MAX_ENEMIES];
+    Body bullets[MAX_BULLETS];
+    Body powerUps[MAX_POWERUPS];
+    int enemyCount, bulletCount, powerUpCount;
+
+    void reset();
+    void spawnNextWave();
+    void spawnPowerUp(int type, float width);
+    void step(std::uint8_t action, float dt);
+    void writeObservation(float *obs) const;
+};
+
+void Env::reset() {
+    time = 0.f;
+    lastShot = 0.f;
+    lastPowerUp = 0.f;
+    steps = 0;
+    playerX = PLAYER_START_CENTER_X - PLAYER_W / 2.f;
+    lives = INITIAL_LIVES;
+    score = 0;
+    nukeCount = 0;
+    slowCount = 0;
+    level = 0;
+    waveLength = INITIAL_WAVE_LENGTH;
+    enemyVelocity = BASE_ENEMY_VELOCITY;
+    enemyCount = bulletCount = powerUpCount = 0;
+    spawnNextWave();
+}
+
+void Env::spawnPowerUp(int type, float width) {
+    if (powerUpCount >= MAX_POWERUPS) return;
+    float minX = SPAWN_MARGIN;
+    float maxX = std::max(minX, SCREEN_WIDTH - width - SPAWN_MARGIN);
+    Body &p = powerUps[powerUpCount++];
+    p.x = static_cast<float>(rng.randint(static_cast<int>(minX), static_cast<int>(maxX)));
+    p.y = static_cast<float>(-rng.randint(POWERUP_SPAWN_MIN_ABOVE, POWERUP_SPAWN_MAX_ABOVE));
+    p.velocity = POWERUP_FALL_SPEED;
+    p.type = type;
+}
+
+void Env::spawnNextWave() {
+    waveLength += 1;
+    if (lives > 0) level += 1;
+    enemyVelocity = BASE_ENEMY_VELOCITY + (level - 1) * ENEMY_VELOCITY_PER_LEVEL;
+
+    int toSpawn = std::min(std::min(waveLength, MAX_ENEMIES), MAX_ENEMIES - enemyCount);
+    float minX = SPAWN_MARGIN;
+    float maxX = std::max(minX, SCREEN_WIDTH - ENEMY_W - SPAWN_MARGIN);
+    for (int i = 0; i < toSpawn; ++i) {
+        Body &e = enemies[enemyCount++];
+        e.x = static_cast<float>(rng.randint(static_cast<int>(minX), static_cast<int>(maxX)));
+        e.y = static_cast<float>(-rng.randint(ENEMY_SPAWN_MIN_ABOVE, ENEMY_SPAWN_MAX_ABOVE));
+        e.velocity = enemyVelocity;
+        e.type = 0;
+    }
+
+    if (level % NUKE_EVERY_LEVELS == 0) spawnPowerUp(NUKE, NUKE_W);
+    if (level % SLOW_EVERY_LEVELS == 0) spawnPowerUp(SLOW, SLOW_W);
+}
+
+// One frame of Game::update, in the same order
+void Env::step(std::uint8_t action, float dt) {
+    time += dt;
+    steps += 1;
+
+    // handleInput
+    float moveX = 0.f;
+    if (action & GD_ACTION_LEFT)  moveX -= PLAYER_SPEED * dt;
+    if (action & GD_ACTION_RIGHT) moveX += PLAYER_SPEED * dt;
+    playerX = std::max(0.f, std::min(playerX + moveX, SCREEN_WIDTH - PLAYER_W));
+
+    if ((action & GD_ACTION_SHOOT) && time - lastShot >= SHOOT_COOLDOWN && bulletCount < MAX_BULLETS) {
+        lastShot = time;
+        Body &b = bullets[bulletCount++];
+        b.x = playerX + PLAYER_W / 2.f - BULLET_W / 2.f;
+        b.y = PLAYER_Y - BULLET_H;
+        b.velocity = BULLET_SPEED;
+        b.type = 0;
+    }
+
+    if (time - lastPowerUp >= POWERUP_COOLDOWN) {
+        if ((action & GD_ACTION_NUKE)) {
+            if (nukeCount > 0) {
+                score += enemyCount;
+                enemyCount = 0;
+                nukeCount -= 1;
+            }
+            lastPowerUp = time;
+        }
+        if ((action & GD_ACTION_SLOW)) {
+            if (slowCount > 0) {
+                float reduction = SLOW_REDUCTION;
+                if (enemyVelocity > reduction) enemyVelocity -= reduction;
+                else enemyVelocity = std::max(SLOW_MIN_VELOCITY, enemyVelocity - reduction);
+                slowCount -= 1;
+            }
+            lastPowerUp = time;
+        }
+    }
+
+    // Player::update: move bullets, drop the ones above the screen
+    for (int i = 0; i < bulletCount;) {
+        bullets[i].y -= bullets[i].velocity * dt;
+        if (bullets[i].y + BULLET_H < 0.f) removeAt(bullets, bulletCount, i);
+        else ++i;
+    }
+
+    // Enemies descend; the ones past the bottom cost a life
+    for (int i = 0; i < enemyCount;) {
+        enemies[i].y += enemies[i].velocity * dt;
+        if (enemies[i].y > SCREEN_HEIGHT) {
+            lives -= 1;
+            swapRemoveAt(enemies, enemyCount, i);
+        } else ++i;
+    }
+
+    // Power-ups fall until they pass the bottom of the screen
+    for (int i = 0; i < powerUpCount;) {
+        powerUps[i].y += powerUps[i].velocity * dt;
+        if (powerUps[i].y > SCREEN_HEIGHT) swapRemoveAt(powerUps, powerUpCount, i);
+        else ++i;
+    }
+
+    // Bullets vs enemies: each bullet destroys at most one enemy
+    for (int b = 0; b < bulletCount;) {
+        bool hit = false;
+        if (!inView(bullets[b].x, bullets[b].y, BULLET_W, BULLET_H)) { ++b; continue; }
+        for (int e = 0; e < enemyCount; ++e) {
+            if (inView(enemies[e].x, enemies[e].y, ENEMY_W, ENEMY_H) &&
+                intersects(bullets[b].x, bullets[b].y, BULLET_W, BULLET_H,
+                           enemies[e].x, enemies[e].y, ENEMY_W, ENEMY_H)) {
+                swapRemoveAt(enemies, enemyCount, e);
+                score += 1;
+                hit = true;
+                break;
+            }
+        }
+        if (hit) removeAt(bullets, bulletCount, b);
+        else ++b;
+    }
+
+    // Player vs enemies
+    for (int e = 0; e < enemyCount;) {
+        if (inView(enemies[e].x, enemies[e].y, ENEMY_W, ENEMY_H) &&
+            intersects(playerX, PLAYER_Y, PLAYER_W, PLAYER_H,
+                       enemies[e].x, enemies[e].y, ENEMY_W, ENEMY_H)) {
+            swapRemoveAt(enemies, enemyCount, e);
+            lives -= 1;
+        } else ++e;
+    }
+
+    // Power-up collection
+    for (int p = 0; p < powerUpCount;) {
+        float w = powerUps[p].type == NUKE ? NUKE_W : SLOW_W;
+        float h = powerUps[p].type == NUKE ? NUKE_H : SLOW_H;
+        if (inView(powerUps[p].x, powerUps[p].y, w, h) &&
+            intersects(playerX, PLAYER_Y, PLAYER_W, PLAYER_H, powerUps[p].x, powerUps[p].y, w, h)) {
+            if (powerUps[p].type == NUKE) nukeCount += 1;
+            else slowCount += 1;
+            swapRemoveAt(powerUps, powerUpCount, p);
+        } else ++p;
+    }
+
+    if (enemyCount == 0) spawnNextWave();
+}
+
+void Env::writeObservation(float *obs) const {
+    obs[GD_OBS_PLAYER_X]   = playerX;
+    obs[GD_OBS_LIVES]      = static_cast<float>(lives);
+    obs[GD_OBS_SCORE]      = static_cast<float>(score);
+    obs[GD_OBS_NUKES]      = static_cast<float>(nukeCount);
+    obs[GD_OBS_SLOWS]      = static_cast<float>(slowCount);
+    obs[GD_OBS_LEVEL]      = static_cast<float>(level);
+    obs[GD_OBS_N_ENEMIES]  = static_cast<float>(enemyCount);
+    obs[GD_OBS_N_POWERUPS] = static_cast<float>(powerUpCount);
+    obs[GD_OBS_N_BULLETS]  = static_cast<float>(bulletCount);
+
+    float *e = obs + GD_OBS_ENEMY_BASE;
+    for (int i = 0; i < GD_OBS_ENEMIES; ++i, e += 3) {
+        bool present = i < enemyCount;
+        e[0] = present ? enemies[i].x : 0.f;
+        e[1] = present ? enemies[i].y : 0.f;
+        e[2] = present ? 1.f : 0.f;
+    }
+
+    float *p = obs + GD_OBS_POWERUP_BASE;
+    for (int i = 0; i < GD_OBS_POWERUPS; ++i, p += 3) {
+        bool present = i < powerUpCount;
+        p[0] = present ? powerUps[i].x : 0.f;
+        p[1] = present ? powerUps[i].y : 0.f;
+        p[2] = present ? static_cast<float>(powerUps[i].type) : 0.f;
+    }
+}
+
+} // namespace
+
+struct GdBatch {
+    std::vector<Env> envs;
+    float dt;
+    int maxEpisodeSteps;
+};
+
+extern "C" {
+
+GdBatch* gd_create(int num_envs, uint64_t seed, float dt, int max_episode_steps) {
+    if (num_envs <= 0) return nullptr;
+
+    GdBatch *batch = new (std::nothrow) GdBatch();
+    if (!batch) return nullptr;
+    try {
+        batch->envs.resize(static_cast<std::size_t>(num_envs));
+    } catch (...) {
+        delete batch;
+        return nullptr;
+    }
+    batch->dt = dt > 0.f ? dt : 1.f / 60.f;
+    batch->maxEpisodeSteps = std::max(0, max_episode_steps);
+
+    // Give every environment its own stream derived from the batch seed
+    Rng seeder{seed};
+    for (auto &env : batch->envs) {
+        env.rng.state = seeder.next();
+        env.reset();
+    }
+    return batch;
+}
+
+void gd_destroy(GdBatch* batch) {
+    delete batch;
+}
+
+int gd_num_envs(const GdBatch* batch) {
+    return batch ? static_cast<int>(batch->envs.size()) : 0;
+}
+
+int gd_obs_size(void) {
+    return GD_OBS_SIZE;
+}
+
+void gd_reset_all(GdBatch* batch, float* obs) {
+    if (!batch) return;
+    for (std::size_t i = 0; i < batch->envs.size(); ++i) {
+        batch->envs[i].reset();
+        if (obs) batch->envs[i].writeObservation(obs + i * GD_OBS_SIZE);
+    }
+}
+
+void gd_step_batch(GdBatch* batch, const uint8_t* actions,
+                   float* obs, float* rewards, uint8_t* dones) {
+    if (!batch || !actions || !obs || !rewards || !dones) return;
+
+    const float dt = batch->dt;
+    const int maxSteps = batch->maxEpisodeSteps;
+    const std::size_t n = batch->envs.size();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        Env &env = batch->envs[i];
+        int scoreBefore = env.score;
+
+        env.step(actions[i], dt);
+
+        rewards[i] = static_cast<float>(env.score - scoreBefore);
+        bool done = env.lives <= 0 || (maxSteps > 0 && env.steps >= maxSteps);
+        dones[i] = done ? 1 : 0;
+        if (done) env.reset();
+
+        env.writeObservation(obs + i * GD_OBS_SIZE);
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,70 @@
+#ifndef AUDIO_HPP
+#define AUDIO_HPP
+
+#include <SFML/Audio.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Sound effects the game can trigger. Count must stay last.
+enum class Sfx {
+    Shoot,
+    EnemyHit,
+    PlayerHit,
+    PowerUpCollect,
+    Nuke,
+    Slow,
+    WaveStart,
+    Count
+};
+
+// Audio owns every sound the game plays.
+// All effects are decoded into sf::SoundBuffers once at load time. Each effect
+// has its own small pool of sf::Sound voices, bound to its buffer in load(),
+// so triggering a sound only restarts (or stops) existing voices: it never
+// opens a file, rebinds a buffer or allocates.
+// Music is streamed by sf::Music, which decodes on its own thread.
+class Audio {
+public:
+    static constexpr std::size_t VOICE_COUNT = 16; // voices over all pools
+    static constexpr std::size_t MAX_PLAYING = 12; // effects audible at once
+
+    Audio() = default;
+    Audio(const Audio&) = delete;            // voices point into our buffers
+    Audio& operator=(const Audio&) = delete;
+
+    // Decode all effects from sounds/ and open the music stream if there is one.
+    // Returns false if any effect is missing (the game still runs silently).
+    bool load();
+
+    // Start an effect on a free voice of its pool, or restart the pool's oldest.
+    // When MAX_PLAYING effects are already audible, the lowest priority (oldest
+    // on ties) one is stopped, unless it is more important than the new effect.
+    void play(Sfx effect);
+
+    void playMusic();  // start (or resume) the looping background track
+    void stopMusic();
+
+private:
+    struct Voice {
+        sf::Sound sound;
+        int priority = 0;          // priority of the effect this voice is bound to
+        std::uint64_t started = 0; // play() counter value when it started
+    };
+
+    static int priorityOf(Sfx effect);
+    Voice* pickVoice(Sfx effect);
+    bool makeRoom(int priority);
+
+    static constexpr std::size_t SFX_COUNT = static_cast<std::size_t>(Sfx::Count);
+
+    std::array<sf::SoundBuffer, SFX_COUNT> buffers;
+    std::array<bool, SFX_COUNT> loaded{};   // false if the file failed to decode
+    std::array<Voice, VOICE_COUNT> voices;
+    std::uint64_t playCounter = 0;
+
+    sf::Music music;
+    bool musicLoaded = false;
+};
+
+#endif // AUDIO_HPP
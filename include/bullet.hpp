@@ -2,11 +2,12 @@
 #define BULLET_HPP
 
 #include "entity.hpp"
+#include "gameRules.hpp"
 
 // Bullet moves upwards player bullets
 class Bullet : public Entity {
 public:
-    float speed = 350.f; // pixels per second (upwards)
+    float speed = rules::BULLET_SPEED; // pixels per second (upwards)
     // bullet state activeor not
     bool active = true;  // set to false when it should be removed
 
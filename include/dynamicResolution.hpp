@@ -0,0 +1,69 @@
+#ifndef DYNAMICRESOLUTION_HPP
+#define DYNAMICRESOLUTION_HPP
+
+#include <SFML/Graphics.hpp>
+
+// DynamicResolution separates the logical playfield from the window.
+// The scene is drawn in playfield coordinates into an offscreen texture, then
+// stretched (letterboxed, aspect kept) onto the window. Only part of that
+// texture is used: the render scale shrinks when frames take longer than the
+// budget and grows back when there is headroom, so slow machines trade
+// sharpness for frame rate while fast ones render at full output resolution.
+//
+// The frame cost fed to update() comes from CPU timers (see
+// FramePacer::lastFrameCost). GPU work is not timed directly: it only shows up
+// when display() blocks because the GPU is behind (without vsync), or, with
+// vsync, when a frame misses its vblank. So under vsync the scale only drops
+// once frames are already being missed, and after a drop it waits a while
+// before growing back toward the size that missed.
+class DynamicResolution {
+public:
+    DynamicResolution(float logicalWidth, float logicalHeight);
+
+    // Window size changed: recompute the letterbox and reallocate the texture
+    void resize(unsigned windowWidth, unsigned windowHeight);
+
+    // Feed last frame's cost; adjusts the render scale toward the target
+    void update(float frameSeconds, float targetFrameSeconds);
+
+    // Clear the offscreen target and return it, set up for playfield coordinates
+    sf::RenderTarget& beginScene(const sf::Color &clearColor = sf::Color::Black);
+
+    // Upscale the scene into the letterboxed area of the window
+    void present(sf::RenderWindow &win);
+
+    // View for drawing overlays (HUD) in playfield coordinates directly on the window
+    const sf::View& getOverlayView() const { return overlayView; }
+
+    // Window pixels per playfield unit in the overlay view
+    float getOverlayScale() const;
+
+    float getScale() const { return scale; }
+    sf::Vector2u getRenderSize() const;   // pixels actually rendered this frame
+    sf::Vector2u getOutputSize() const { return outputSize; }
+
+private:
+    static constexpr float MIN_SCALE = 0.5f;
+    static constexpr float SCALE_STEP = 0.05f;  // scale changes in these increments
+    static constexpr float HEADROOM = 0.85f;    // aim to use this much of the frame budget
+    static constexpr int SETTLE_FRAMES = 20;    // frames to wait after a change
+    static constexpr int REGROW_FRAMES = 180;   // frames to wait after shrinking before growing
+
+    sf::Vector2f logicalSize;
+    sf::RenderTexture target;   // sized to the full output resolution
+    sf::View sceneView;         // playfield coordinates into the used part of target
+    sf::View overlayView;       // playfield coordinates onto the window letterbox
+    sf::Sprite output;
+    sf::RectangleShape clearRect; // clears only the part of target in use
+
+    sf::Vector2u outputSize{0, 0};   // letterboxed area in window pixels
+    sf::Vector2f outputOffset{0.f, 0.f};
+    sf::Vector2u windowSize{0, 0};
+
+    float scale = 1.f;          // fraction of outputSize rendered per axis
+    float smoothedTime = 0.f;   // moving average of frame cost
+    int framesSinceChange = 0;
+    int framesSinceShrink = REGROW_FRAMES;
+};
+
+#endif // DYNAMICRESOLUTION_HPP
@@ -16,8 +16,8 @@ public:
     // Update internal logic by delta time (seconds)
     virtual void update(float dt) = 0;
 
-    // Draw this entity to the provided window
-    virtual void draw(sf::RenderWindow &win);
+    // Draw this entity to the provided window or offscreen target
+    virtual void draw(sf::RenderTarget &target);
 
     // Get axis-aligned bounding box (used for simple collision)
     virtual sf::FloatRect getBounds() const;
@@ -0,0 +1,123 @@
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <SFML/System.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// How the frame rate is limited
+enum class PacingMode {
+    VSync,      // display() blocks on the monitor refresh, pacer never waits
+    SleepSpin,  // sleep most of the remaining time, then spin to the deadline
+    Uncapped    // run as fast as possible
+};
+
+// Parts of a frame, in the order they happen inside Game::run()
+enum class FramePhase {
+    Events,   // window event polling
+    Update,   // game logic
+    Render,   // building the frame (draw calls)
+    Wait,     // time the pacer spent waiting for the deadline
+    Present,  // window.display()
+    Count
+};
+
+// Summary of everything recorded so far
+struct FrameStats {
+    std::uint64_t frames = 0;
+    std::uint64_t lateFrames = 0;
+    float averageMs = 0.f;
+    float worstMs = 0.f;
+    float low1Fps = 0.f;     // FPS of the 99th percentile frame time
+    float low01Fps = 0.f;    // FPS of the 99.9th percentile frame time
+    std::array<std::uint64_t, static_cast<std::size_t>(FramePhase::Count)> lateByPhase{};
+};
+
+// FramePacer replaces window.setFramerateLimit(): it decides when a frame is
+// presented, measures the real present-to-present interval, keeps a histogram
+// of those intervals and blames every late frame on its slowest phase.
+//
+// Usage per frame:
+//   dt = beginFrame(); ... endPhase(Events) ... endPhase(Update) ...
+//   endPhase(Render); waitForDeadline(); window.display(); endPhase(Present); endFrame();
+class FramePacer {
+public:
+    explicit FramePacer(float targetFps = 60.f, PacingMode mode = PacingMode::SleepSpin);
+
+    void setMode(PacingMode m);
+    PacingMode getMode() const { return mode; }
+    void setTargetFps(float fps);
+
+    // Start a frame. Returns seconds since the previous frame started.
+    float beginFrame();
+
+    // Close the phase that has been running since the last mark
+    void endPhase(FramePhase phase);
+
+    // In SleepSpin mode block until the next present deadline (records the Wait phase)
+    void waitForDeadline();
+
+    // Finish the frame after presenting; records the interval and late-frame info
+    void endFrame();
+
+    // Duration of a phase in the last finished frame, in seconds
+    float phaseTime(FramePhase phase) const;
+
+    // What the last frame cost, in seconds, for load balancing: its CPU work
+    // (events + update + render), plus present when not vsync-locked, since
+    // display() then blocks only when the GPU falls behind. With vsync, display()
+    // always blocks until the vblank, so a frame that missed one reports its
+    // whole present interval instead.
+    float lastFrameCost() const;
+
+    float lastIntervalMs() const { return lastInterval; }
+    // Frame time we are aiming for: the target rate, or in VSync mode the
+    // measured refresh interval once enough frames have been seen
+    float targetFrameTime() const;
+
+    FrameStats stats() const;
+    void printReport(std::ostream &out) const;
+    void resetStats();
+
+    static const char* phaseName(FramePhase phase);
+    static const char* modeName(PacingMode mode);
+
+private:
+    static constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(FramePhase::Count);
+    static constexpr float BUCKET_MS = 0.1f;          // histogram resolution
+    static constexpr std::size_t BUCKET_COUNT = 1000; // 0..100 ms, last bucket catches the rest
+    static constexpr float LATE_TOLERANCE = 1.25f;    // late when interval > period * this
+    static constexpr std::uint64_t REFRESH_SAMPLE = 60; // VSync: re-estimate refresh every this many frames
+
+    float percentileMs(double fraction) const;
+    float estimateRefreshMs() const;
+
+    PacingMode mode;
+    sf::Time period;                 // target frame duration
+    float refreshMs = 0.f;           // VSync: estimated refresh interval, 0 until measured
+    sf::Time spinMargin;             // how early we wake up from sleep to spin
+    sf::Clock clock;                 // single time base for everything
+    sf::Time frameStart;
+    sf::Time lastMark;
+    sf::Time lastPresent;
+    sf::Time nextDeadline;
+    bool firstFrame = true;
+    bool resync = true;              // restart the deadline sequence from now
+
+    std::array<sf::Time, PHASE_COUNT> phases{};     // current frame
+    std::array<sf::Time, PHASE_COUNT> lastPhases{}; // last finished frame
+    float lastInterval = 0.f;                       // ms
+    bool lastLate = false;                          // last finished frame was late
+
+    // Histogram and running totals
+    std::array<std::uint32_t, BUCKET_COUNT> histogram{};
+    std::uint64_t frames = 0;
+    std::uint64_t lateFrames = 0;
+    double totalMs = 0.0;
+    float worstMs = 0.f;
+    std::array<std::uint64_t, PHASE_COUNT> lateByPhase{};
+};
+
+#endif // FRAMEPACER_HPP
@@ -0,0 +1,113 @@
+#ifndef GALACTIC_ENV_H
+#define GALACTIC_ENV_H
+
+/*
+ * Headless batch environment for training bots against Galactic Defender.
+ *
+ * A batch holds N independent games that follow the same rules as Game
+ * (movement, shooting cooldown, waves, power-ups, collisions) but without a
+ * window, textures or keyboard. One gd_step_batch() call advances every game
+ * by one fixed time step. Observations, rewards and done flags are written
+ * straight into caller-owned contiguous buffers, so stepping never allocates.
+ *
+ * Plain C interface so it can be loaded from Python (ctypes/cffi) or any
+ * other language. The source lives in env/, away from the game's sources in src/.
+ * Build as a shared library with GD_BUILD defined, for example:
+ *   g++ -O2 -shared -fPIC -DGD_BUILD env/galacticEnv.cpp -Iinclude -o galactic_env.dll
+ */
+
+#include <stdint.h>
+
+/* Exported when building the library, imported by code linking against it */
+#if defined(_WIN32)
+#  ifdef GD_BUILD
+#    define GD_API __declspec(dllexport)
+#  else
+#    define GD_API __declspec(dllimport)
+#  endif
+#else
+#  define GD_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Action bits, one uint8_t per environment. Bits can be combined like keys. */
+enum {
+    GD_ACTION_LEFT  = 1 << 0, /* A */
+    GD_ACTION_RIGHT = 1 << 1, /* D */
+    GD_ACTION_SHOOT = 1 << 2, /* W */
+    GD_ACTION_NUKE  = 1 << 3, /* N */
+    GD_ACTION_SLOW  = 1 << 4  /* Space */
+};
+
+/* Fixed slot counts in the observation */
+enum {
+    GD_OBS_ENEMIES  = 6, /* the game never has more than 6 enemies */
+    GD_OBS_POWERUPS = 4  /* power-ups beyond the first 4 slots are not reported */
+};
+
+/*
+ * Observation layout, GD_OBS_SIZE floats per environment, positions in pixels
+ * of the 720x450 playfield (top-left of each sprite, y grows downward):
+ *   [GD_OBS_PLAYER_X]   player x
+ *   [GD_OBS_LIVES]      lives left
+ *   [GD_OBS_SCORE]      score
+ *   [GD_OBS_NUKES]      nuke power-ups held
+ *   [GD_OBS_SLOWS]      slow power-ups held
+ *   [GD_OBS_LEVEL]      current level
+ *   [GD_OBS_N_ENEMIES]  number of enemies alive
+ *   [GD_OBS_N_POWERUPS] number of power-ups falling
+ *   [GD_OBS_N_BULLETS]  number of player bullets in flight
+ *   then GD_OBS_ENEMIES  x (x, y, present) triples
+ *   then GD_OBS_POWERUPS x (x, y, type) triples, type 0 = empty, 1 = nuke, 2 = slow
+ */
+enum {
+    GD_OBS_PLAYER_X = 0,
+    GD_OBS_LIVES,
+    GD_OBS_SCORE,
+    GD_OBS_NUKES,
+    GD_OBS_SLOWS,
+    GD_OBS_LEVEL,
+    GD_OBS_N_ENEMIES,
+    GD_OBS_N_POWERUPS,
+    GD_OBS_N_BULLETS,
+    GD_OBS_ENEMY_BASE,
+    GD_OBS_POWERUP_BASE = GD_OBS_ENEMY_BASE + 3 * GD_OBS_ENEMIES,
+    GD_OBS_SIZE         = GD_OBS_POWERUP_BASE + 3 * GD_OBS_POWERUPS
+};
+
+typedef struct GdBatch GdBatch;
+
+/*
+ * Create num_envs games. dt is the simulated seconds per step (1/60 if <= 0).
+ * max_episode_steps truncates long episodes (0 = only end on game over).
+ * Returns NULL on bad arguments or out of memory.
+ */
+GD_API GdBatch* gd_create(int num_envs, uint64_t seed, float dt, int max_episode_steps);
+GD_API void     gd_destroy(GdBatch* batch);
+
+GD_API int      gd_num_envs(const GdBatch* batch);
+GD_API int      gd_obs_size(void);
+
+/* Restart every game and write num_envs * GD_OBS_SIZE floats into obs. */
+GD_API void     gd_reset_all(GdBatch* batch, float* obs);
+
+/*
+ * Advance every game by one step.
+ *   actions: num_envs action bitmasks
+ *   obs:     num_envs * GD_OBS_SIZE floats (out)
+ *   rewards: num_envs floats, score gained this step (out)
+ *   dones:   num_envs flags, 1 when the episode ended this step (out)
+ * A finished game is reset inside the call: its reward and done flag describe
+ * the final step, while obs already holds the first state of the new episode.
+ */
+GD_API void     gd_step_batch(GdBatch* batch, const uint8_t* actions,
+                              float* obs, float* rewards, uint8_t* dones);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GALACTIC_ENV_H */
@@ -5,9 +5,26 @@
 #include "player.hpp"
 #include "enemy.hpp"
 #include "powerUp.hpp"
+#include "audio.hpp"
+#include "framePacer.hpp"
+#include "slotMap.hpp"
+#include "dynamicResolution.hpp"
 #include <vector>
 #include <memory>
 
+// What a pending spawn turns into once it reaches the screen
+enum class SpawnType { Enemy, Nuke, Slow };
+
+// A scheduled spawn that is still above the screen. Only this record exists
+// until activateAt, when the real entity is created at the top edge.
+struct PendingSpawn {
+    float x;
+    float startY;      // y at activateAt: -height, or the spawn y if it began partly visible
+    float activateAt;  // game time (seconds) when its bottom edge enters the view
+    float velocity;    // falling speed, fixed when the wave was spawned
+    SpawnType type;
+};
+
 class Game {
 public:
     Game();           // constructor loads resources and configures window
@@ -21,22 +38,41 @@ private:
     void render();
     void handleInput(float dt);
     void spawnNextWave();
+    void scheduleSpawn(SpawnType type, float x, float y, float velocity, float height);
+    void activatePendingSpawns();  // turn due PendingSpawns into entities
+    bool inView(const sf::FloatRect &bounds) const; // false for anything off-screen
     void checkBulletEnemyCollisions();
     void checkPlayerEnemyCollisions();  // check if player collides with enemies
     void checkPowerUpCollection();
     void activateNukePowerUp();    // activate nuke when SPACE pressed
     void activateSlowPowerUp();    // activate slow when R pressed
     void reset();     // restart game after losing
+    void applyPacingMode(PacingMode mode); // switch window vsync and pacer together
 
     // Window and textures/sprites
     sf::RenderWindow window;
     sf::Texture texPlayer, texEnemy, texLaser, texBG, texNuke, texSlow;
     sf::Sprite background;
 
+    // Sound effects and music
+    Audio audio;
+
+    // Decides when frames are presented and records frame-time statistics
+    FramePacer pacer;
+
+    // Offscreen scene target whose resolution follows measured frame time
+    DynamicResolution resolution;
+
     // Game state
     Player player;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::unique_ptr<PowerUp>> powerUps;
+    // Slot maps so erasing is O(1) and other code can hold SlotHandles to them
+    SlotMap<std::unique_ptr<Enemy>> enemies;
+    SlotMap<std::unique_ptr<PowerUp>> powerUps;
+
+    // Spawns waiting above the screen, latest activation first so the next due is at the back
+    std::vector<PendingSpawn> spawnQueue;
+    int pendingEnemies = 0;  // enemies still in spawnQueue
+    float gameTime = 0.f;    // seconds of gameplay (stops on game over)
 
     float baseEnemyVelocity;
     float enemyVelocity;
@@ -47,7 +83,7 @@ private:
 
     // Power-up activation cooldown (to prevent rapid activation)
     sf::Clock powerUpCooldown;
-    float powerUpCooldownTime = 0.3f; // seconds between activations
+    float powerUpCooldownTime = rules::POWERUP_COOLDOWN; // seconds between activations
 };
 
 #endif // GAME_HPP
@@ -0,0 +1,51 @@
+#ifndef GAMERULES_HPP
+#define GAMERULES_HPP
+
+// Numbers that define the gameplay. Game and the headless training
+// environment (env/galacticEnv.cpp) both read them from here, so a bot trains
+// on the same rules the player sees. Plain constants only, no SFML: the
+// environment is built without it.
+namespace rules {
+
+// Logical playfield in pixels; all gameplay happens in these coordinates
+constexpr int PLAYFIELD_WIDTH  = 720;
+constexpr int PLAYFIELD_HEIGHT = 450;
+
+// Sprite sizes are the pixel sizes of the textures in images/.
+// The environment has no textures, so Game::loadResources checks they match.
+constexpr float PLAYER_WIDTH = 152.f, PLAYER_HEIGHT = 206.f; // images/player.png
+constexpr float BULLET_WIDTH = 10.f,  BULLET_HEIGHT = 30.f;  // images/laser.png
+constexpr float ENEMY_WIDTH  = 124.f, ENEMY_HEIGHT  = 124.f; // images/enemy.png
+constexpr float NUKE_WIDTH   = 50.f,  NUKE_HEIGHT   = 50.f;  // images/boost.png
+constexpr float SLOW_WIDTH   = 300.f, SLOW_HEIGHT   = 369.f; // images/slow.png
+
+// Player
+constexpr float PLAYER_START_CENTER_X = 350.f;
+constexpr float PLAYER_Y = 380.f;
+constexpr float PLAYER_SPEED = 320.f;    // px/sec
+constexpr float SHOOT_COOLDOWN = 0.20f;  // seconds between shots
+constexpr float BULLET_SPEED = 350.f;    // px/sec upwards
+constexpr int INITIAL_LIVES = 3;
+
+// Waves
+constexpr int INITIAL_WAVE_LENGTH = 3;   // grows by one before every wave
+constexpr int MAX_ENEMIES = 6;           // on screen and queued together
+constexpr float BASE_ENEMY_VELOCITY = 60.f;
+constexpr float ENEMY_VELOCITY_PER_LEVEL = 12.f;
+constexpr int NUKE_EVERY_LEVELS = 2;     // a nuke falls on every 2nd level
+constexpr int SLOW_EVERY_LEVELS = 3;
+
+// Spawning: x keeps this far from the side edges, y starts this far above the top
+constexpr float SPAWN_MARGIN = 10.f;
+constexpr int ENEMY_SPAWN_MIN_ABOVE = 20,   ENEMY_SPAWN_MAX_ABOVE = 600;
+constexpr int POWERUP_SPAWN_MIN_ABOVE = 20, POWERUP_SPAWN_MAX_ABOVE = 200;
+
+// Power-ups
+constexpr float POWERUP_FALL_SPEED = 80.f;
+constexpr float POWERUP_COOLDOWN = 0.3f;   // seconds between activations
+constexpr float SLOW_REDUCTION = 20.f;     // enemy velocity lost per slow
+constexpr float SLOW_MIN_VELOCITY = 10.f;
+
+} // namespace rules
+
+#endif // GAMERULES_HPP
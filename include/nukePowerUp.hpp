@@ -9,7 +9,7 @@ public:
     NukePowerUp() = default;
     NukePowerUp(const sf::Texture &tx, const sf::Vector2f &pos);
 
-    void applyEffect(Player &player, std::vector<std::unique_ptr<Enemy>> &enemies, float &enemyVelocity) override;
+    void applyEffect(Player &player, SlotMap<std::unique_ptr<Enemy>> &enemies, float &enemyVelocity) override;
 };
 
 #endif // NUKEPOWERUP_HPP
@@ -3,6 +3,7 @@
 
 #include "ship.hpp"
 #include "bullet.hpp"
+#include "gameRules.hpp"
 #include <vector>
 #include <memory>
 #include <SFML/System.hpp>
@@ -10,7 +11,7 @@
 // Player class manages bullets, lives, score, and shooting cooldown
 class Player : public Ship {
 public:
-    int lives = 3;
+    int lives = rules::INITIAL_LIVES;
     int score = 0;
     int nukeCount = 0;      // number of nuke power-ups collected
     int slowCount = 0;      // number of slow power-ups collected
@@ -18,7 +19,7 @@ public:
     std::vector<std::unique_ptr<Bullet>> bullets; //  a list (vector) that will store bullets, and each bullet is stored using a unique_ptr so that it automatically deletes it when it's no longer needed.
 
     sf::Clock shootClock;      // to enforce cooldown
-    float shootCooldown = 0.20f; // seconds between shots
+    float shootCooldown = rules::SHOOT_COOLDOWN; // seconds between shots
 
     Player() = default;
 
@@ -26,7 +27,8 @@ public:
     Player(const sf::Texture &tx, const sf::Vector2f &pos);
 
     // Attempt to shoot (creates a Bullet if cooldown elapsed)
-    void shoot(const sf::Texture &bulletTex);
+    // Returns true when a bullet was actually fired
+    bool shoot(const sf::Texture &bulletTex);
 
     // Update bullets (remove inactive ones)
     void update(float dt) override;
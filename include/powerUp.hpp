@@ -4,16 +4,19 @@
 #include "entity.hpp"
 #include "player.hpp"
 #include "enemy.hpp"
-#include <vector>
+#include "slotMap.hpp"
+#include "gameRules.hpp"
+#include <memory>
 
 // Abstract base for collectible power-ups
 class PowerUp : public Entity {
 public:
     bool active = true; // removed when false
-    float velocity = 80.f;// falling speed
+    static constexpr float FALL_SPEED = rules::POWERUP_FALL_SPEED;
+    float velocity = FALL_SPEED;// falling speed
 
     // Apply power-up effect derived classes implement behavior
-    virtual void applyEffect(Player &player, std::vector<std::unique_ptr<Enemy>> &enemies, float &enemyVelocity) = 0;
+    virtual void applyEffect(Player &player, SlotMap<std::unique_ptr<Enemy>> &enemies, float &enemyVelocity) = 0;
 
     void update(float dt) override;
 };
@@ -0,0 +1,131 @@
+#ifndef SLOTMAP_HPP
+#define SLOTMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Stable reference to an element of a SlotMap.
+// The generation changes every time a slot is reused, so a handle to an
+// element that was removed never points at whatever replaced it.
+struct SlotHandle {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID;   // slot in the slot table
+    std::uint32_t generation = 0;    // must match the slot's current generation
+
+    bool valid() const { return index != INVALID; }
+    bool operator==(const SlotHandle &o) const { return index == o.index && generation == o.generation; }
+    bool operator!=(const SlotHandle &o) const { return !(*this == o); }
+};
+
+// Generational slot map: O(1) insert, erase and lookup by handle.
+// Values live packed in one vector so iterating is a plain loop over them.
+// Erasing moves the last value into the hole (swap-and-pop), so erase never
+// shifts the rest and handles stay valid; only the dense order changes.
+//
+// To erase while iterating, walk by dense index and do not advance after eraseAt(i):
+//   for (std::size_t i = 0; i < map.size();) { if (dead(map[i])) map.eraseAt(i); else ++i; }
+template <typename T>
+class SlotMap {
+public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SlotHandle insert(T value) {
+        std::uint32_t slotIndex;
+        if (!freeSlots.empty()) {
+            slotIndex = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<std::uint32_t>(slots.size());
+            slots.push_back(Slot{});
+        }
+
+        slots[slotIndex].denseIndex = static_cast<std::uint32_t>(dense.size());
+        dense.push_back(std::move(value));
+        denseToSlot.push_back(slotIndex);
+        return SlotHandle{slotIndex, slots[slotIndex].generation};
+    }
+
+    // Remove the element a handle refers to. Returns false if it was already gone.
+    bool erase(SlotHandle h) {
+        if (!contains(h)) return false;
+        eraseAt(slots[h.index].denseIndex);
+        return true;
+    }
+
+    // Remove by position in the dense array (for use while iterating)
+    void eraseAt(std::size_t denseIndex) {
+        std::uint32_t slotIndex = denseToSlot[denseIndex];
+        std::size_t last = dense.size() - 1;
+
+        if (denseIndex != last) {
+            dense[denseIndex] = std::move(dense[last]);
+            denseToSlot[denseIndex] = denseToSlot[last];
+            slots[denseToSlot[denseIndex]].denseIndex = static_cast<std::uint32_t>(denseIndex);
+        }
+        dense.pop_back();
+        denseToSlot.pop_back();
+
+        // Bump the generation so every handle to this slot becomes stale
+        slots[slotIndex].generation += 1;
+        freeSlots.push_back(slotIndex);
+    }
+
+    bool contains(SlotHandle h) const {
+        return h.index < slots.size() && slots[h.index].generation == h.generation &&
+               slots[h.index].denseIndex < dense.size() && denseToSlot[slots[h.index].denseIndex] == h.index;
+    }
+
+    // nullptr when the handle is stale
+    T* get(SlotHandle h) { return contains(h) ? &dense[slots[h.index].denseIndex] : nullptr; }
+    const T* get(SlotHandle h) const { return contains(h) ? &dense[slots[h.index].denseIndex] : nullptr; }
+
+    // Handle for the element currently at a dense position
+    SlotHandle handleAt(std::size_t denseIndex) const {
+        std::uint32_t slotIndex = denseToSlot[denseIndex];
+        return SlotHandle{slotIndex, slots[slotIndex].generation};
+    }
+
+    void clear() {
+        for (std::uint32_t slotIndex : denseToSlot) {
+            slots[slotIndex].generation += 1;
+            freeSlots.push_back(slotIndex);
+        }
+        dense.clear();
+        denseToSlot.clear();
+    }
+
+    void reserve(std::size_t n) {
+        dense.reserve(n);
+        denseToSlot.reserve(n);
+        slots.reserve(n);
+        freeSlots.reserve(n);
+    }
+
+    std::size_t size() const { return dense.size(); }
+    bool empty() const { return dense.empty(); }
+
+    T& operator[](std::size_t denseIndex) { return dense[denseIndex]; }
+    const T& operator[](std::size_t denseIndex) const { return dense[denseIndex]; }
+
+    iterator begin() { return dense.begin(); }
+    iterator end() { return dense.end(); }
+    const_iterator begin() const { return dense.begin(); }
+    const_iterator end() const { return dense.end(); }
+
+private:
+    struct Slot {
+        std::uint32_t denseIndex = 0;
+        std::uint32_t generation = 0;
+    };
+
+    std::vector<T> dense;                  // the values, packed
+    std::vector<std::uint32_t> denseToSlot;// slot owning each dense value
+    std::vector<Slot> slots;               // handle index -> dense position
+    std::vector<std::uint32_t> freeSlots;  // slots ready for reuse
+};
+
+#endif // SLOTMAP_HPP
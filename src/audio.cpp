@@ -0,0 +1,126 @@
+#include "audio.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace {
+// File for each Sfx value, in enum order
+const char* const SFX_FILES[] = {
+    "sounds/shoot.wav",
+    "sounds/enemy_hit.wav",
+    "sounds/player_hit.wav",
+    "sounds/powerup.wav",
+    "sounds/nuke.wav",
+    "sounds/slow.wav",
+    "sounds/wave.wav",
+};
+static_assert(sizeof(SFX_FILES) / sizeof(SFX_FILES[0]) == static_cast<std::size_t>(Sfx::Count),
+              "every Sfx needs a file");
+
+// Voices reserved for each Sfx value, in enum order. Shots overlap the most.
+constexpr std::size_t POOL_SIZES[] = {5, 4, 2, 2, 1, 1, 1};
+static_assert(sizeof(POOL_SIZES) / sizeof(POOL_SIZES[0]) == static_cast<std::size_t>(Sfx::Count),
+              "every Sfx needs a pool");
+
+constexpr std::size_t poolStart(std::size_t effect) {
+    return effect == 0 ? 0 : poolStart(effect - 1) + POOL_SIZES[effect - 1];
+}
+static_assert(poolStart(static_cast<std::size_t>(Sfx::Count)) == Audio::VOICE_COUNT,
+              "pools must add up to VOICE_COUNT");
+
+const char* const MUSIC_FILE = "sounds/music.ogg";
+}
+
+bool Audio::load() {
+    bool ok = true;
+
+    for (std::size_t i = 0; i < SFX_COUNT; ++i) {
+        loaded[i] = buffers[i].loadFromFile(SFX_FILES[i]);
+        if (!loaded[i]) { std::cerr << "Failed to load " << SFX_FILES[i] << "\n"; ok = false; continue; }
+
+        // Binding a buffer registers the sound with it (an allocation), so do it once here
+        for (std::size_t v = poolStart(i); v < poolStart(i + 1); ++v) {
+            voices[v].sound.setBuffer(buffers[i]);
+            voices[v].priority = priorityOf(static_cast<Sfx>(i));
+        }
+    }
+
+    // Music is optional and not shipped. Only open it when the file exists,
+    // otherwise SFML reports a failure on every launch.
+    musicLoaded = std::ifstream(MUSIC_FILE).good() && music.openFromFile(MUSIC_FILE);
+    if (musicLoaded) {
+        music.setLoop(true);
+        music.setVolume(40.f);
+    }
+
+    return ok;
+}
+
+int Audio::priorityOf(Sfx effect) {
+    // Higher wins when voices run out. Shots are frequent and cheap to lose,
+    // events the player must notice are never cut off by them.
+    switch (effect) {
+        case Sfx::Shoot:          return 0;
+        case Sfx::EnemyHit:       return 1;
+        case Sfx::PowerUpCollect: return 2;
+        case Sfx::Slow:           return 2;
+        case Sfx::WaveStart:      return 2;
+        case Sfx::PlayerHit:      return 3;
+        case Sfx::Nuke:           return 3;
+        default:                  return 0;
+    }
+}
+
+Audio::Voice* Audio::pickVoice(Sfx effect) {
+    std::size_t i = static_cast<std::size_t>(effect);
+    Voice* oldest = nullptr;
+    for (std::size_t v = poolStart(i); v < poolStart(i + 1); ++v) {
+        // A voice that finished (or never played) is free
+        if (voices[v].sound.getStatus() != sf::Sound::Playing) return &voices[v];
+        if (!oldest || voices[v].started < oldest->started) oldest = &voices[v];
+    }
+    return oldest;
+}
+
+bool Audio::makeRoom(int priority) {
+    std::size_t playing = 0;
+    Voice* victim = nullptr;
+    for (auto &v : voices) {
+        if (v.sound.getStatus() != sf::Sound::Playing) continue;
+        playing += 1;
+
+        // Remember the least important, oldest one
+        if (!victim || v.priority < victim->priority ||
+            (v.priority == victim->priority && v.started < victim->started)) {
+            victim = &v;
+        }
+    }
+    if (playing < MAX_PLAYING) return true;
+
+    // Never cut off something more important than the new sound
+    if (victim->priority > priority) return false;
+    victim->sound.stop();
+    return true;
+}
+
+void Audio::play(Sfx effect) {
+    std::size_t i = static_cast<std::size_t>(effect);
+    if (i >= SFX_COUNT || !loaded[i]) return;
+
+    Voice* v = pickVoice(effect);
+
+    // Restarting a voice of our own pool does not add to the playing count
+    if (v->sound.getStatus() != sf::Sound::Playing && !makeRoom(v->priority)) {
+        return; // too many more important sounds already playing
+    }
+
+    v->started = ++playCounter;
+    v->sound.play(); // restarts from the beginning if it was playing
+}
+
+void Audio::playMusic() {
+    if (musicLoaded && music.getStatus() != sf::Music::Playing) music.play();
+}
+
+void Audio::stopMusic() {
+    if (musicLoaded) music.stop();
+}
@@ -0,0 +1,108 @@
+#include "dynamicResolution.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+DynamicResolution::DynamicResolution(float logicalWidth, float logicalHeight)
+: logicalSize(logicalWidth, logicalHeight),
+  sceneView(sf::FloatRect(0.f, 0.f, logicalWidth, logicalHeight)),
+  overlayView(sf::FloatRect(0.f, 0.f, logicalWidth, logicalHeight))
+{
+}
+
+void DynamicResolution::resize(unsigned windowWidth, unsigned windowHeight) {
+    if (windowWidth == 0 || windowHeight == 0) return; // minimized
+    windowSize = sf::Vector2u(windowWidth, windowHeight);
+
+    // Largest area with the playfield's aspect ratio that fits, centered
+    float fit = std::min(windowWidth / logicalSize.x, windowHeight / logicalSize.y);
+    unsigned maxSize = sf::Texture::getMaximumSize();
+    unsigned w = std::min(maxSize, std::max(1u, static_cast<unsigned>(std::lround(logicalSize.x * fit))));
+    unsigned h = std::min(maxSize, std::max(1u, static_cast<unsigned>(std::lround(logicalSize.y * fit))));
+    outputOffset = sf::Vector2f((windowWidth - w) / 2.f, (windowHeight - h) / 2.f);
+
+    overlayView.setViewport(sf::FloatRect(outputOffset.x / windowWidth, outputOffset.y / windowHeight,
+                                          static_cast<float>(w) / windowWidth,
+                                          static_cast<float>(h) / windowHeight));
+
+    // The texture only changes when the output size does; the render scale
+    // just uses less of it, so scaling never reallocates
+    if (w == outputSize.x && h == outputSize.y) return;
+    if (!target.create(w, h)) {
+        std::cerr << "Failed to create " << w << "x" << h << " render target\n";
+        return;
+    }
+    target.setSmooth(true); // bilinear filtering when upscaling
+    outputSize = sf::Vector2u(w, h);
+}
+
+float DynamicResolution::getOverlayScale() const {
+    return outputSize.x > 0 ? outputSize.x / logicalSize.x : 1.f;
+}
+
+sf::Vector2u DynamicResolution::getRenderSize() const {
+    return sf::Vector2u(std::max(1u, static_cast<unsigned>(std::lround(outputSize.x * scale))),
+                        std::max(1u, static_cast<unsigned>(std::lround(outputSize.y * scale))));
+}
+
+void DynamicResolution::update(float frameSeconds, float targetFrameSeconds) {
+    if (frameSeconds <= 0.f || targetFrameSeconds <= 0.f) return;
+
+    // Smooth out single slow frames so the scale does not flicker
+    smoothedTime = smoothedTime > 0.f ? smoothedTime + (frameSeconds - smoothedTime) * 0.1f : frameSeconds;
+    ++framesSinceShrink;
+    if (++framesSinceChange < SETTLE_FRAMES) return;
+
+    float budget = targetFrameSeconds * HEADROOM;
+    float next = scale;
+    if (smoothedTime > budget) {
+        // Pixel cost grows with scale squared, so shrink by the square root of the overrun,
+        // and always by at least one step
+        next = scale * std::sqrt(budget / smoothedTime);
+        next = std::min(std::floor(next / SCALE_STEP) * SCALE_STEP, scale - SCALE_STEP);
+    } else if (smoothedTime < budget * 0.7f && framesSinceShrink >= REGROW_FRAMES) {
+        // Plenty of room: creep back up one step at a time. Right after a shrink
+        // the room may only be the CPU side (vsync hides GPU cost), so hold off.
+        next = scale + SCALE_STEP;
+    }
+    next = std::max(MIN_SCALE, std::min(next, 1.f));
+
+    if (std::fabs(next - scale) > 0.001f) {
+        if (next < scale) framesSinceShrink = 0;
+        scale = next;
+        framesSinceChange = 0;
+    }
+}
+
+sf::RenderTarget& DynamicResolution::beginScene(const sf::Color &clearColor) {
+    // target.clear() would fill the whole full-resolution texture even at low
+    // scale. Overwrite only the used area, plus one texel so bilinear upscaling
+    // never samples leftovers from a frame rendered at a larger scale.
+    sf::Vector2u used = getRenderSize();
+    target.setView(target.getDefaultView());
+    clearRect.setSize(sf::Vector2f(static_cast<float>(std::min(used.x + 1, outputSize.x)),
+                                   static_cast<float>(std::min(used.y + 1, outputSize.y))));
+    clearRect.setFillColor(clearColor);
+    target.draw(clearRect, sf::RenderStates(sf::BlendNone));
+
+    // Map the playfield onto the top-left renderSize pixels of the texture
+    sceneView.setViewport(sf::FloatRect(0.f, 0.f,
+                                        static_cast<float>(used.x) / outputSize.x,
+                                        static_cast<float>(used.y) / outputSize.y));
+    target.setView(sceneView);
+    return target;
+}
+
+void DynamicResolution::present(sf::RenderWindow &win) {
+    target.display();
+
+    sf::Vector2u used = getRenderSize();
+    output.setTexture(target.getTexture());
+    output.setTextureRect(sf::IntRect(0, 0, static_cast<int>(used.x), static_cast<int>(used.y)));
+    output.setScale(static_cast<float>(outputSize.x) / used.x, static_cast<float>(outputSize.y) / used.y);
+    output.setPosition(outputOffset);
+
+    // Draw in window pixels
+    win.setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(windowSize.x), static_cast<float>(windowSize.y))));
+    win.draw(output);
+}
@@ -1,9 +1,9 @@
 #include "Entity.hpp"
 
-void Entity::draw(sf::RenderWindow &win) {
+void Entity::draw(sf::RenderTarget &target) {
     // Ensure sprite is at the entity's position before drawing
     sprite.setPosition(position);
-    win.draw(sprite);
+    target.draw(sprite);
 }
 
 sf::FloatRect Entity::getBounds() const {
@@ -0,0 +1,234 @@
+#include "framePacer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+float toMs(sf::Time t) { return t.asMicroseconds() / 1000.f; }
+
+const sf::Time MIN_SPIN_MARGIN = sf::microseconds(500);
+const sf::Time MAX_SPIN_MARGIN = sf::milliseconds(4);
+}
+
+FramePacer::FramePacer(float targetFps, PacingMode m)
+: mode(m), spinMargin(sf::milliseconds(2))
+{
+    setTargetFps(targetFps);
+}
+
+void FramePacer::setMode(PacingMode m) {
+    // Intervals from another mode say nothing about this one
+    if (m != mode) resetStats();
+    mode = m;
+    resync = true;
+}
+
+void FramePacer::setTargetFps(float fps) {
+    if (fps <= 0.f) fps = 60.f;
+    period = sf::microseconds(static_cast<sf::Int64>(1000000.f / fps));
+    resync = true;
+}
+
+float FramePacer::beginFrame() {
+    sf::Time now = clock.getElapsedTime();
+    sf::Time dt = firstFrame ? period : now - frameStart;
+    frameStart = now;
+    lastMark = now;
+    phases.fill(sf::Time::Zero);
+    return dt.asSeconds();
+}
+
+void FramePacer::endPhase(FramePhase phase) {
+    sf::Time now = clock.getElapsedTime();
+    phases[static_cast<std::size_t>(phase)] += now - lastMark;
+    lastMark = now;
+}
+
+void FramePacer::waitForDeadline() {
+    if (mode != PacingMode::SleepSpin) { endPhase(FramePhase::Wait); return; }
+
+    sf::Time now = clock.getElapsedTime();
+
+    // If we fell more than a whole frame behind, start over instead of rushing
+    // several frames out back to back to catch up
+    if (resync || now > nextDeadline + period) {
+        nextDeadline = now;
+        resync = false;
+    }
+
+    sf::Time remaining = nextDeadline - now;
+    if (remaining > spinMargin) {
+        // sf::sleep is only accurate to the OS scheduler tick, so wake up early
+        sf::Time sleepFor = remaining - spinMargin;
+        sf::sleep(sleepFor);
+
+        // Adapt the margin to how badly this sleep overshot: grow at once, shrink slowly
+        sf::Time overshoot = clock.getElapsedTime() - now - sleepFor;
+        sf::Time wanted = overshoot + MIN_SPIN_MARGIN;
+        if (wanted > spinMargin) spinMargin = wanted;
+        else spinMargin -= (spinMargin - wanted) / static_cast<sf::Int64>(16);
+        spinMargin = std::max(MIN_SPIN_MARGIN, std::min(spinMargin, MAX_SPIN_MARGIN));
+    }
+
+    // Spin for the last stretch
+    while (clock.getElapsedTime() < nextDeadline) {}
+
+    nextDeadline += period;
+    endPhase(FramePhase::Wait);
+}
+
+void FramePacer::endFrame() {
+    sf::Time now = clock.getElapsedTime();
+
+    if (!firstFrame) {
+        float ms = toMs(now - lastPresent);
+        lastInterval = ms;
+
+        std::size_t bucket = std::min(static_cast<std::size_t>(ms / BUCKET_MS), BUCKET_COUNT - 1);
+        histogram[bucket] += 1;
+        frames += 1;
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+
+        // With vsync the real period is the display's refresh interval, which SFML
+        // cannot report, so it is estimated from the histogram
+        if (mode == PacingMode::VSync && frames % REFRESH_SAMPLE == 0) {
+            refreshMs = estimateRefreshMs();
+        }
+
+        // Late frame: blame whichever phase (other than our own waiting) took longest.
+        // In VSync mode nothing is judged until the refresh interval is known.
+        float expectedMs = mode == PacingMode::VSync ? refreshMs : toMs(period);
+        lastLate = mode != PacingMode::Uncapped && expectedMs > 0.f && ms > expectedMs * LATE_TOLERANCE;
+        if (lastLate) {
+            lateFrames += 1;
+            std::size_t blame = 0;
+            for (std::size_t i = 1; i < PHASE_COUNT; ++i) {
+                if (i == static_cast<std::size_t>(FramePhase::Wait)) continue;
+                if (phases[i] > phases[blame]) blame = i;
+            }
+            lateByPhase[blame] += 1;
+        }
+    }
+
+    lastPresent = now;
+    lastPhases = phases;
+    firstFrame = false;
+}
+
+float FramePacer::targetFrameTime() const {
+    if (mode == PacingMode::VSync && refreshMs > 0.f) return refreshMs / 1000.f;
+    return period.asSeconds();
+}
+
+float FramePacer::phaseTime(FramePhase phase) const {
+    return lastPhases[static_cast<std::size_t>(phase)].asSeconds();
+}
+
+float FramePacer::lastFrameCost() const {
+    if (mode == PacingMode::VSync && lastLate) return lastInterval / 1000.f;
+    float t = phaseTime(FramePhase::Events) + phaseTime(FramePhase::Update) + phaseTime(FramePhase::Render);
+    if (mode != PacingMode::VSync) t += phaseTime(FramePhase::Present);
+    return t;
+}
+
+float FramePacer::percentileMs(double fraction) const {
+    if (frames == 0) return 0.f;
+    std::uint64_t target = static_cast<std::uint64_t>(frames * fraction);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += histogram[i];
+        if (seen > target) return (i + 1) * BUCKET_MS; // upper edge of the bucket
+    }
+    return BUCKET_COUNT * BUCKET_MS;
+}
+
+// Vsync intervals are whole multiples of the refresh interval, so the refresh is
+// the shortest interval the game presents at regularly: the first 0.5 ms window
+// of the histogram holding at least 5% of frames. If even that is clearly slower
+// than the target rate, the game is missing vblanks on nearly every frame, and
+// it is taken as a multiple of a refresh close to the target. (This misreads a
+// display that is itself much slower than the target, e.g. 30 Hz for a 60 fps target.)
+float FramePacer::estimateRefreshMs() const {
+    const std::size_t WINDOW = 5;
+    const std::uint64_t minCount = std::max<std::uint64_t>(1, frames / 20);
+
+    std::uint64_t windowSum = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        windowSum += histogram[i];
+        if (i >= WINDOW) windowSum -= histogram[i - WINDOW];
+        if (windowSum < minCount) continue;
+
+        // Found the cluster; its most used bucket is the interval
+        std::size_t first = i + 1 >= WINDOW ? i + 1 - WINDOW : 0;
+        std::size_t last = std::min(i + WINDOW, BUCKET_COUNT);
+        std::size_t peak = first;
+        for (std::size_t k = first; k < last; ++k) {
+            if (histogram[k] > histogram[peak]) peak = k;
+        }
+        float ms = (peak + 0.5f) * BUCKET_MS;
+
+        long multiple = std::max(1L, std::lround(ms / toMs(period)));
+        return ms / multiple;
+    }
+    return toMs(period);
+}
+
+FrameStats FramePacer::stats() const {
+    FrameStats s;
+    s.frames = frames;
+    s.lateFrames = lateFrames;
+    s.averageMs = frames ? static_cast<float>(totalMs / frames) : 0.f;
+    s.worstMs = worstMs;
+    float p99 = percentileMs(0.99);
+    float p999 = percentileMs(0.999);
+    s.low1Fps = p99 > 0.f ? 1000.f / p99 : 0.f;
+    s.low01Fps = p999 > 0.f ? 1000.f / p999 : 0.f;
+    s.lateByPhase = lateByPhase;
+    return s;
+}
+
+void FramePacer::printReport(std::ostream &out) const {
+    FrameStats s = stats();
+    float avgFps = s.averageMs > 0.f ? 1000.f / s.averageMs : 0.f;
+
+    out << "Frame pacing (" << modeName(mode) << ", target " << targetFrameTime() * 1000.f << " ms)\n";
+    out << "  frames: " << s.frames << "  avg: " << s.averageMs << " ms (" << avgFps << " fps)"
+        << "  worst: " << s.worstMs << " ms\n";
+    out << "  1% low: " << s.low1Fps << " fps  0.1% low: " << s.low01Fps << " fps\n";
+    out << "  late frames: " << s.lateFrames;
+    for (std::size_t i = 0; i < PHASE_COUNT; ++i) {
+        if (s.lateByPhase[i] == 0) continue;
+        out << "  " << phaseName(static_cast<FramePhase>(i)) << "=" << s.lateByPhase[i];
+    }
+    out << "\n";
+}
+
+void FramePacer::resetStats() {
+    histogram.fill(0);
+    frames = 0;
+    lateFrames = 0;
+    totalMs = 0.0;
+    worstMs = 0.f;
+    lateByPhase.fill(0);
+    refreshMs = 0.f;
+}
+
+const char* FramePacer::phaseName(FramePhase phase) {
+    switch (phase) {
+        case FramePhase::Events:  return "events";
+        case FramePhase::Update:  return "update";
+        case FramePhase::Render:  return "render";
+        case FramePhase::Wait:    return "wait";
+        case FramePhase::Present: return "present";
+        default:                  return "?";
+    }
+}
+
+const char* FramePacer::modeName(PacingMode mode) {
+    switch (mode) {
+        case PacingMode::VSync:     return "vsync";
+        case PacingMode::SleepSpin: return "sleep+spin";
+        case PacingMode::Uncapped:  return "uncapped";
+        default:                    return "?";
+    }
+}
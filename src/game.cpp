@@ -1,30 +1,55 @@
 #include "game.hpp"
 #include "nukePowerUp.hpp"
 #include "slowPowerUp.hpp"
+#include "gameRules.hpp"
 
 #include <iostream>
 #include <random>
 #include <algorithm>
+#include <cmath>
 
 // helper random number generator
 static std::mt19937 rng((unsigned)std::random_device{}());
 static int randint(int a, int b) { std::uniform_int_distribution<int> d(a,b); return d(rng); }
-static constexpr int SCREEN_WIDTH  = 720;
-static constexpr int SCREEN_HEIGHT = 450;
+// Logical playfield size (see gameRules.hpp), whatever the size of the window it is shown in
+using rules::PLAYFIELD_WIDTH;
+using rules::PLAYFIELD_HEIGHT;
+
+// Start the window at the largest whole multiple of the playfield that fits
+// in 80% of the desktop (1x on small kiosk screens, 3x on a 3840x2160 monitor)
+static sf::VideoMode initialVideoMode() {
+    sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
+    unsigned fit = std::min(desktop.width * 4 / 5 / PLAYFIELD_WIDTH, desktop.height * 4 / 5 / PLAYFIELD_HEIGHT);
+    fit = std::max(1u, fit);
+    return sf::VideoMode(PLAYFIELD_WIDTH * fit, PLAYFIELD_HEIGHT * fit);
+}
+
+// HUD text is positioned in playfield units but must be rasterized at window
+// resolution: render the glyphs hudScale times larger and shrink them back, so
+// the overlay view maps them 1:1 onto window pixels
+static void setHudTextSize(sf::Text &txt, unsigned size, float hudScale) {
+    txt.setCharacterSize(static_cast<unsigned>(std::lround(size * hudScale)));
+    txt.setScale(1.f / hudScale, 1.f / hudScale);
+}
 
 Game::Game()
-: window(sf::VideoMode(SCREEN_WIDTH, SCREEN_HEIGHT), "Galactic Defender"), baseEnemyVelocity(60.f),
-  level(0), waveLength(3), initialLives(3)
+: window(initialVideoMode(), "Galactic Defender"), resolution(PLAYFIELD_WIDTH, PLAYFIELD_HEIGHT),
+  baseEnemyVelocity(rules::BASE_ENEMY_VELOCITY), level(0), waveLength(rules::INITIAL_WAVE_LENGTH),
+  initialLives(rules::INITIAL_LIVES)
 {
-    window.setFramerateLimit(60);
+    applyPacingMode(PacingMode::SleepSpin);
+    resolution.resize(window.getSize().x, window.getSize().y);
     enemyVelocity = baseEnemyVelocity;
 
     if (!loadResources()) {
         std::cout << "Warning: some resources failed to load. Check images/ folder.\n";
     }
+    if (!audio.load()) {
+        std::cout << "Warning: some sounds failed to load. Check sounds/ folder.\n";
+    }
 
     // Place player near bottom-center
-    player = Player(texPlayer, sf::Vector2f(350.f - texPlayer.getSize().x/2.f, 380.f));
+    player = Player(texPlayer, sf::Vector2f(rules::PLAYER_START_CENTER_X - texPlayer.getSize().x/2.f, rules::PLAYER_Y));
     player.lives = initialLives;
 }
 
@@ -39,6 +64,23 @@ bool Game::loadResources() {
     if (!texNuke.loadFromFile("images/boost.png"))    { std::cerr << "Failed to load images/boost.png\n";   ok = false; }
     if (!texSlow.loadFromFile("images/slow.png"))     { std::cerr << "Failed to load images/slow.png\n";   ok = false; }
 
+    // The training environment has no textures and takes sprite sizes from
+    // gameRules.hpp instead; a different image would make the two disagree
+    auto checkSize = [&ok](const sf::Texture &tx, const char *file, float w, float h) {
+        sf::Vector2u size = tx.getSize();
+        if (size.x == 0) return; // failed to load, already reported
+        if (size.x != static_cast<unsigned>(w) || size.y != static_cast<unsigned>(h)) {
+            std::cerr << file << " is " << size.x << "x" << size.y << ", gameRules.hpp expects "
+                      << w << "x" << h << "\n";
+            ok = false;
+        }
+    };
+    checkSize(texPlayer, "images/player.png", rules::PLAYER_WIDTH, rules::PLAYER_HEIGHT);
+    checkSize(texEnemy,  "images/enemy.png",  rules::ENEMY_WIDTH,  rules::ENEMY_HEIGHT);
+    checkSize(texLaser,  "images/laser.png",  rules::BULLET_WIDTH, rules::BULLET_HEIGHT);
+    checkSize(texNuke,   "images/boost.png",  rules::NUKE_WIDTH,   rules::NUKE_HEIGHT);
+    checkSize(texSlow,   "images/slow.png",   rules::SLOW_WIDTH,   rules::SLOW_HEIGHT);
+
     background.setTexture(texBG);
 
     // Try to load font from multiple locations
@@ -67,22 +109,57 @@ bool Game::loadResources() {
 }
 
 void Game::run() {
-    sf::Clock clock;
+    audio.playMusic();
     spawnNextWave();
 
     while (window.isOpen()) {
-        float dt = clock.restart().asSeconds();
+        float dt = pacer.beginFrame();
         handleEvents();
+        pacer.endPhase(FramePhase::Events);
         update(dt);
+        pacer.endPhase(FramePhase::Update);
         render();
+        pacer.endPhase(FramePhase::Render);
+
+        // Wait for the deadline before presenting so frames go out evenly spaced
+        pacer.waitForDeadline();
+        window.display();
+        pacer.endPhase(FramePhase::Present);
+        pacer.endFrame();
+
+        // Pick next frame's render resolution from what this one cost
+        resolution.update(pacer.lastFrameCost(), pacer.targetFrameTime());
     }
+
+    pacer.printReport(std::cout);
+}
+
+void Game::applyPacingMode(PacingMode mode) {
+    // Only one limiter may be active, SFML's own limit would fight the pacer
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(mode == PacingMode::VSync);
+    pacer.setMode(mode);
 }
 
 void Game::handleEvents() {
     sf::Event ev;
     while (window.pollEvent(ev)) {
         if (ev.type == sf::Event::Closed) window.close();
+        if (ev.type == sf::Event::Resized) resolution.resize(ev.size.width, ev.size.height);
         if (ev.type == sf::Event::KeyPressed && ev.key.code == sf::Keyboard::Escape) window.close();
+        // F3 prints frame-time statistics, F4 cycles vsync / sleep+spin / uncapped
+        if (ev.type == sf::Event::KeyPressed && ev.key.code == sf::Keyboard::F3) {
+            pacer.printReport(std::cout);
+            sf::Vector2u rs = resolution.getRenderSize(), os = resolution.getOutputSize();
+            std::cout << "  render: " << rs.x << "x" << rs.y << " upscaled to " << os.x << "x" << os.y << "\n";
+        }
+        if (ev.type == sf::Event::KeyPressed && ev.key.code == sf::Keyboard::F4) {
+            PacingMode next = pacer.getMode() == PacingMode::VSync     ? PacingMode::SleepSpin
+                            : pacer.getMode() == PacingMode::SleepSpin ? PacingMode::Uncapped
+                            :                                            PacingMode::VSync;
+            applyPacingMode(next);
+            std::cout << "Frame pacing: " << FramePacer::modeName(next) << "\n";
+        }
         // Allow restart when game is over
         if (ev.type == sf::Event::KeyPressed && ev.key.code == sf::Keyboard::R && player.lives <= 0) {
             reset();
@@ -98,14 +175,14 @@ void Game::handleInput(float dt) {
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::D))
         moveX += player.speed * dt;
 
-    // Clamp player x to window bounds
+    // Clamp player x to playfield bounds
     auto bounds = player.sprite.getLocalBounds();
-    player.position.x = std::max(0.f, std::min(player.position.x + moveX, SCREEN_WIDTH - bounds.width));
+    player.position.x = std::max(0.f, std::min(player.position.x + moveX, PLAYFIELD_WIDTH - bounds.width));
 
 
     // Shooting: W 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) )
-        player.shoot(texLaser);
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) && player.shoot(texLaser))
+        audio.play(Sfx::Shoot);
 
     // Activate power-ups: N for boost (nuke), SPACE for decelerator (slow) (with cooldown to prevent rapid activation)
     if (powerUpCooldown.getElapsedTime().asSeconds() >= powerUpCooldownTime) {
@@ -126,6 +203,8 @@ void Game::update(float dt) {
         return; // Stop all game logic, only handle events and render
     }
 
+    gameTime += dt;
+
     handleInput(dt);
 
     // Update player bullets and other player internal state
@@ -134,23 +213,29 @@ void Game::update(float dt) {
     // Update enemies positions
     for (auto &e : enemies) if (e) e->update(dt);
 
-    // Remove enemies that passed bottom and decrease lives
-    enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-                [&](const std::unique_ptr<Enemy>& e){
-                    if (!e) return true;
-                    if (e->position.y > SCREEN_HEIGHT) {
-                        player.lives -= 1;
-                        return true;
-                    }
-                    return false;
-                }), enemies.end());
-
     // Update power-ups falling
     for (auto &p : powerUps) if (p) p->update(dt);
 
-    // Remove inactive powerups
-    powerUps.erase(std::remove_if(powerUps.begin(), powerUps.end(),
-                [](const std::unique_ptr<PowerUp>& p){ return !p->active; }), powerUps.end());
+    // Bring in scheduled spawns that reached the top of the screen this frame
+    // (placed where they would be now, so they need no update of their own)
+    activatePendingSpawns();
+
+    // Remove enemies that passed bottom and decrease lives
+    // (eraseAt moves the last enemy into slot i, so i is not advanced after a removal)
+    for (std::size_t i = 0; i < enemies.size();) {
+        if (!enemies[i]) { enemies.eraseAt(i); continue; }
+        if (enemies[i]->position.y > PLAYFIELD_HEIGHT) {
+            player.lives -= 1;
+            audio.play(Sfx::PlayerHit);
+            enemies.eraseAt(i);
+        } else ++i;
+    }
+
+    // Remove inactive powerups and those that fell past the bottom (they can never come back)
+    for (std::size_t i = 0; i < powerUps.size();) {
+        if (!powerUps[i] || !powerUps[i]->active || powerUps[i]->position.y > PLAYFIELD_HEIGHT) powerUps.eraseAt(i);
+        else ++i;
+    }
 
     // Collisions: bullets vs enemies
     checkBulletEnemyCollisions();
@@ -161,14 +246,14 @@ void Game::update(float dt) {
     // Player collects power-ups
     checkPowerUpCollection();
 
-    // If no enemies remain spawn next wave
-    if (enemies.empty()) {
+    // If no enemies remain (on screen or still queued) spawn next wave
+    if (enemies.empty() && pendingEnemies == 0) {
         spawnNextWave();
     }
     
     // Ensure we never exceed 6 enemies (safety check)
-    if (enemies.size() > 6) {
-        enemies.erase(enemies.begin() + 6, enemies.end());
+    while (enemies.size() > static_cast<std::size_t>(rules::MAX_ENEMIES)) {
+        enemies.eraseAt(enemies.size() - 1);
     }
 
     // Slow power-up is manually activated, no timer needed
@@ -182,15 +267,17 @@ void Game::spawnNextWave() {
         level += 1;
     }
     
+    if (player.lives > 0) audio.play(Sfx::WaveStart);
+
     // Update enemy velocity based on current level
-    enemyVelocity = baseEnemyVelocity + (level-1)*12.f;
+    enemyVelocity = baseEnemyVelocity + (level-1)*rules::ENEMY_VELOCITY_PER_LEVEL;
 
     // Limit wave length to ensure max 6 enemies
-    int enemiesToSpawn = std::min(waveLength, 6);
+    int enemiesToSpawn = std::min(waveLength, rules::MAX_ENEMIES);
     
     // Only spawn if we have less than 6 enemies
-    int currentEnemyCount = static_cast<int>(enemies.size());
-    int maxToSpawn = std::max(0, 6 - currentEnemyCount);
+    int currentEnemyCount = static_cast<int>(enemies.size()) + pendingEnemies;
+    int maxToSpawn = std::max(0, rules::MAX_ENEMIES - currentEnemyCount);
     enemiesToSpawn = std::min(enemiesToSpawn, maxToSpawn);
 
     for (int i = 0; i < enemiesToSpawn; ++i) {
@@ -201,65 +288,109 @@ void Game::spawnNextWave() {
         
         // Spawn enemies within screen bounds (not in borders)
         // Ensure enemy fits completely within screen width
-        float minX = 10.f;
-        float maxX = SCREEN_WIDTH - enemyBounds.width - 10.f;
+        float minX = rules::SPAWN_MARGIN;
+        float maxX = PLAYFIELD_WIDTH - enemyBounds.width - rules::SPAWN_MARGIN;
         if (maxX < minX) maxX = minX; // safety check
         
         float ex = static_cast<float>(randint(static_cast<int>(minX), static_cast<int>(maxX)));
-        float ey = static_cast<float>(-randint(20, 600));
-        enemies.emplace_back(std::make_unique<Enemy>(texEnemy, sf::Vector2f(ex, ey), enemyVelocity));
+        float ey = static_cast<float>(-randint(rules::ENEMY_SPAWN_MIN_ABOVE, rules::ENEMY_SPAWN_MAX_ABOVE));
+        scheduleSpawn(SpawnType::Enemy, ex, ey, enemyVelocity, enemyBounds.height);
     }
 
     // Spawn power-ups occasionally - use same bounds checking as enemies
-    if (level % 2 == 0) {
+    if (level % rules::NUKE_EVERY_LEVELS == 0) {
         // Get nuke power-up sprite bounds to ensure proper spawning
         sf::Sprite tempNukeSprite;
         tempNukeSprite.setTexture(texNuke);
         auto nukeBounds = tempNukeSprite.getLocalBounds();
         
         // Spawn within screen bounds (not in borders) - same logic as enemies
-        float minX = 10.f;
-        float maxX = SCREEN_WIDTH - nukeBounds.width - 10.f;
+        float minX = rules::SPAWN_MARGIN;
+        float maxX = PLAYFIELD_WIDTH - nukeBounds.width - rules::SPAWN_MARGIN;
         if (maxX < minX) maxX = minX; // safety check
         
         float nukeX = static_cast<float>(randint(static_cast<int>(minX), static_cast<int>(maxX)));
-        float nukeY = static_cast<float>(-randint(20, 200));
-        powerUps.emplace_back(std::make_unique<NukePowerUp>(
-            texNuke, sf::Vector2f(nukeX, nukeY)));
+        float nukeY = static_cast<float>(-randint(rules::POWERUP_SPAWN_MIN_ABOVE, rules::POWERUP_SPAWN_MAX_ABOVE));
+        scheduleSpawn(SpawnType::Nuke, nukeX, nukeY, PowerUp::FALL_SPEED, nukeBounds.height);
     }
-    if (level % 3 == 0) {
+    if (level % rules::SLOW_EVERY_LEVELS == 0) {
         // Get slow power-up sprite bounds to ensure proper spawning
         sf::Sprite tempSlowSprite;
         tempSlowSprite.setTexture(texSlow);
         auto slowBounds = tempSlowSprite.getLocalBounds();
         
         // Spawn within screen bounds (not in borders) - same logic as enemies
-        float minX = 10.f;
-        float maxX = SCREEN_WIDTH - slowBounds.width - 10.f;
+        float minX = rules::SPAWN_MARGIN;
+        float maxX = PLAYFIELD_WIDTH - slowBounds.width - rules::SPAWN_MARGIN;
         if (maxX < minX) maxX = minX; // safety check
         
         float slowX = static_cast<float>(randint(static_cast<int>(minX), static_cast<int>(maxX)));
-        float slowY = static_cast<float>(-randint(20, 200));
-        powerUps.emplace_back(std::make_unique<SlowPowerUp>(
-            texSlow, sf::Vector2f(slowX, slowY)));
+        float slowY = static_cast<float>(-randint(rules::POWERUP_SPAWN_MIN_ABOVE, rules::POWERUP_SPAWN_MAX_ABOVE));
+        scheduleSpawn(SpawnType::Slow, slowX, slowY, PowerUp::FALL_SPEED, slowBounds.height);
+    }
+
+    // Keep the queue ordered latest-first so the next spawn to activate is at the back
+    std::sort(spawnQueue.begin(), spawnQueue.end(),
+              [](const PendingSpawn &a, const PendingSpawn &b){ return a.activateAt > b.activateAt; });
+}
+
+void Game::scheduleSpawn(SpawnType type, float x, float y, float velocity, float height) {
+    // The entity becomes visible once its bottom edge passes y = 0,
+    // i.e. after travelling (-y - height) pixels at its falling speed.
+    // One that already pokes into the view activates at once from its own y.
+    float startY = std::max(y, -height);
+    float delay = (startY - y) / velocity;
+    spawnQueue.push_back({x, startY, gameTime + delay, velocity, type});
+    if (type == SpawnType::Enemy) pendingEnemies += 1;
+}
+
+void Game::activatePendingSpawns() {
+    while (!spawnQueue.empty() && spawnQueue.back().activateAt <= gameTime) {
+        const PendingSpawn s = spawnQueue.back();
+        spawnQueue.pop_back();
+
+        // Place it where it would be now had it been falling since it was scheduled
+        float y = s.startY + s.velocity * (gameTime - s.activateAt);
+        sf::Vector2f pos(s.x, y);
+
+        switch (s.type) {
+            case SpawnType::Enemy:
+                enemies.insert(std::make_unique<Enemy>(texEnemy, pos, s.velocity));
+                pendingEnemies -= 1;
+                break;
+            case SpawnType::Nuke:
+                powerUps.insert(std::make_unique<NukePowerUp>(texNuke, pos));
+                break;
+            case SpawnType::Slow:
+                powerUps.insert(std::make_unique<SlowPowerUp>(texSlow, pos));
+                break;
+        }
     }
 }
 
+bool Game::inView(const sf::FloatRect &bounds) const {
+    static const sf::FloatRect view(0.f, 0.f, (float)PLAYFIELD_WIDTH, (float)PLAYFIELD_HEIGHT);
+    return bounds.intersects(view);
+}
+
 void Game::checkBulletEnemyCollisions() {
     // Loop over each bullet and test intersection with enemies
     for (auto &bptr : player.bullets) {
         if (!bptr) continue;
-        for (auto it = enemies.begin(); it != enemies.end();) {
-            if (!(*it)) { ++it; continue; }
-            if (bptr->getBounds().intersects((*it)->getBounds())) {
+        sf::FloatRect bulletBounds = bptr->getBounds();
+        if (!inView(bulletBounds)) continue;
+        for (std::size_t i = 0; i < enemies.size(); ++i) {
+            if (!enemies[i]) continue;
+            sf::FloatRect enemyBounds = enemies[i]->getBounds();
+            if (inView(enemyBounds) && bulletBounds.intersects(enemyBounds)) {
                 // Hit: deactivate bullet, remove enemy, increase score
-                std::cout << "Hitting an enemy" << std::endl;
+                audio.play(Sfx::EnemyHit);
                 bptr->active = false;
-                (*it)->active = false;
-                it = enemies.erase(it);
+                enemies[i]->active = false;
+                enemies.eraseAt(i);
                 player.score += 1;
                 break; // bullet gone; continue with next bullet
-            } else ++it;
+            }
         }
     }
 
@@ -269,46 +400,57 @@ void Game::checkBulletEnemyCollisions() {
 }
 
 void Game::checkPlayerEnemyCollisions() {
-    // Check if player collides with any enemy
-    for (auto it = enemies.begin(); it != enemies.end();) {
-        if (!(*it)) { ++it; continue; }
-        if (player.getBounds().intersects((*it)->getBounds())) {
+    // Check if player collides with any enemy (only the visible parts can touch)
+    sf::FloatRect playerBounds = player.getBounds();
+    for (std::size_t i = 0; i < enemies.size();) {
+        if (!enemies[i]) { ++i; continue; }
+        sf::FloatRect enemyBounds = enemies[i]->getBounds();
+        if (inView(enemyBounds) && playerBounds.intersects(enemyBounds)) {
             // Collision: remove enemy and decrement player life
-            (*it)->active = false;
-            it = enemies.erase(it);
+            // (the last enemy moves into slot i, so check i again)
+            enemies[i]->active = false;
+            enemies.eraseAt(i);
             player.lives -= 1;
+            audio.play(Sfx::PlayerHit);
         } else {
-            ++it;
+            ++i;
         }
     }
 }
 
 void Game::checkPowerUpCollection() {
-    for (auto it = powerUps.begin(); it != powerUps.end();) {
-        if (!(*it)) { ++it; continue; }
-        if (player.getBounds().intersects((*it)->getBounds())) {
+    sf::FloatRect playerBounds = player.getBounds();
+    for (std::size_t i = 0; i < powerUps.size();) {
+        if (!powerUps[i]) { ++i; continue; }
+        sf::FloatRect powerUpBounds = powerUps[i]->getBounds();
+        if (inView(powerUpBounds) && playerBounds.intersects(powerUpBounds)) {
             // Increment power-up counters instead of applying immediately
-            if (dynamic_cast<NukePowerUp*>((*it).get())) {
+            if (dynamic_cast<NukePowerUp*>(powerUps[i].get())) {
                 player.nukeCount += 1;
-            } else if (dynamic_cast<SlowPowerUp*>((*it).get())) {
+            } else if (dynamic_cast<SlowPowerUp*>(powerUps[i].get())) {
                 player.slowCount += 1;
             }
+            audio.play(Sfx::PowerUpCollect);
 
-            // Remove the powerup after collection
-            it = powerUps.erase(it);
-        } else ++it;
+            // Remove the powerup after collection (swap-and-pop, check slot i again)
+            powerUps.eraseAt(i);
+        } else ++i;
     }
 }
 
 void Game::activateNukePowerUp() {
     // Only activate if player has nuke power-ups
     if (player.nukeCount > 0) {
-        // Add score for each enemy destroyed
-        player.score += static_cast<int>(enemies.size());
+        // Add score for each enemy destroyed, including those still queued above the screen
+        player.score += static_cast<int>(enemies.size()) + pendingEnemies;
         // Clear all enemies
         enemies.clear();
+        spawnQueue.erase(std::remove_if(spawnQueue.begin(), spawnQueue.end(),
+                    [](const PendingSpawn &s){ return s.type == SpawnType::Enemy; }), spawnQueue.end());
+        pendingEnemies = 0;
         // Decrement counter
         player.nukeCount -= 1;
+        audio.play(Sfx::Nuke);
     }
 }
 
@@ -316,35 +458,44 @@ void Game::activateSlowPowerUp() {
     // Only activate if player has slow power-ups
     if (player.slowCount > 0) {
         // Reduce enemy velocity by a fixed amount 
-        // Using 20 pixels/second as the reduction amount
-        float reduction = 20.f;
+        float reduction = rules::SLOW_REDUCTION;
         if (enemyVelocity > reduction) {
             enemyVelocity -= reduction;
         } else {
-            enemyVelocity = std::max(10.f, enemyVelocity - reduction); // ensure minimum speed
+            enemyVelocity = std::max(rules::SLOW_MIN_VELOCITY, enemyVelocity - reduction); // ensure minimum speed
         }
         // Decrement counter
         player.slowCount -= 1;
+        audio.play(Sfx::Slow);
     }
 }
 
 void Game::render() {
-    window.clear();
+    // The scene goes to the offscreen target at the current render scale
+    sf::RenderTarget &scene = resolution.beginScene();
 
     // Background
-    window.draw(background);
+    scene.draw(background);
 
     // Draw enemies
-    for (auto &e : enemies) if (e) e->draw(window);
+    // Only what intersects the view is drawn
+    for (auto &e : enemies) if (e && inView(e->getBounds())) e->draw(scene);
 
     // Draw power-ups
-    for (auto &p : powerUps) if (p) p->draw(window);
+    for (auto &p : powerUps) if (p && inView(p->getBounds())) p->draw(scene);
 
     // Draw bullets
-    for (auto &b : player.bullets) if (b) b->draw(window);
+    for (auto &b : player.bullets) if (b && inView(b->getBounds())) b->draw(scene);
 
     // Draw player
-    player.draw(window);
+    player.draw(scene);
+
+    // Upscale it into the window, then draw the HUD directly on the window
+    // in playfield coordinates, with text rasterized at window resolution
+    window.clear();
+    resolution.present(window);
+    window.setView(resolution.getOverlayView());
+    float hudScale = resolution.getOverlayScale();
 
     // HUD (Lives, Score, Level, Power-ups) - display all game information
     // Check if font is loaded and valid
@@ -354,7 +505,7 @@ void Game::render() {
     if (fontValid) {
         sf::Text txt;
         txt.setFont(font);
-        txt.setCharacterSize(20);
+        setHudTextSize(txt, 20, hudScale);
         txt.setFillColor(sf::Color::Green);
 
         // Lives (top left) - shows current number of lives
@@ -375,19 +526,19 @@ void Game::render() {
         // Level (top right) - shows current level
         txt.setFillColor(sf::Color::White);
         txt.setString("Level: " + std::to_string(level));
-        txt.setPosition(SCREEN_WIDTH - 130.f, 10.f);
+        txt.setPosition(PLAYFIELD_WIDTH - 130.f, 10.f);
         window.draw(txt);
 
         // Score (below level) - shows current score
         txt.setString("Score: " + std::to_string(player.score));
-        txt.setPosition(SCREEN_WIDTH - 130.f, 38.f);
+        txt.setPosition(PLAYFIELD_WIDTH - 130.f, 38.f);
         window.draw(txt);
     }
 
     // Game-over overlay - appears when player has no lives
     if (player.lives <= 0) {
         // Dark overlay to dim the screen
-        sf::RectangleShape overlay(sf::Vector2f((float)SCREEN_WIDTH, (float)SCREEN_HEIGHT));
+        sf::RectangleShape overlay(sf::Vector2f((float)PLAYFIELD_WIDTH, (float)PLAYFIELD_HEIGHT));
         overlay.setFillColor(sf::Color(0,0,0,180));
         window.draw(overlay);
 
@@ -396,41 +547,42 @@ void Game::render() {
             sf::Text gameOver;
             gameOver.setFont(font);
             gameOver.setString("GAME OVER");
-            gameOver.setCharacterSize(50);
+            setHudTextSize(gameOver, 50, hudScale);
             gameOver.setFillColor(sf::Color::Red);
             gameOver.setStyle(sf::Text::Bold);
             
-            // Center the text
+            // Center the text (local bounds are in glyph pixels, hence / hudScale)
             sf::FloatRect textBounds = gameOver.getLocalBounds();
-            gameOver.setPosition(SCREEN_WIDTH/2.f - textBounds.width/2.f, SCREEN_HEIGHT/2.f - 60.f);
+            gameOver.setPosition(PLAYFIELD_WIDTH/2.f - textBounds.width/hudScale/2.f, PLAYFIELD_HEIGHT/2.f - 60.f);
             window.draw(gameOver);
 
             // Restart instruction
             sf::Text restartText;
             restartText.setFont(font);
             restartText.setString("Press R to Restart");
-            restartText.setCharacterSize(24);
+            setHudTextSize(restartText, 24, hudScale);
             restartText.setFillColor(sf::Color::White);
             
             sf::FloatRect restartBounds = restartText.getLocalBounds();
-            restartText.setPosition(SCREEN_WIDTH/2.f - restartBounds.width/2.f, SCREEN_HEIGHT/2.f + 10.f);
+            restartText.setPosition(PLAYFIELD_WIDTH/2.f - restartBounds.width/hudScale/2.f, PLAYFIELD_HEIGHT/2.f + 10.f);
             window.draw(restartText);
         }
     }
-
-    window.display();
 }
 
 void Game::reset() {
     enemies.clear();
     powerUps.clear();
+    spawnQueue.clear();
+    pendingEnemies = 0;
+    gameTime = 0.f;
     player.bullets.clear();
     player.lives = initialLives;
     player.score = 0;
     player.nukeCount = 0;
     player.slowCount = 0;
     level = 0;
-    waveLength = 3;
+    waveLength = rules::INITIAL_WAVE_LENGTH;
     enemyVelocity = baseEnemyVelocity;
     powerUpCooldown.restart();
     spawnNextWave();
@@ -5,19 +5,20 @@ Player::Player(const sf::Texture &tx, const sf::Vector2f &pos) {
     sprite.setTexture(tx);
     sprite.setOrigin(0.f,0.f);
     position = pos;
-    speed = 320.f;
+    speed = rules::PLAYER_SPEED;
     health = 1;
 }
 
 // Create a bullet centered above the player's ship
-void Player::shoot(const sf::Texture &bulletTex) {
-    if (shootClock.getElapsedTime().asSeconds() < shootCooldown) return;
+bool Player::shoot(const sf::Texture &bulletTex) {
+    if (shootClock.getElapsedTime().asSeconds() < shootCooldown) return false;
     shootClock.restart();
 
     // Calculate bullet spawn position: horizontally centered on player
     float bx = position.x + sprite.getGlobalBounds().width/2.f - bulletTex.getSize().x/2.f;
     float by = position.y - bulletTex.getSize().y;
     bullets.emplace_back(std::make_unique<Bullet>(bulletTex, sf::Vector2f(bx, by)));
+    return true;
 }
 
 void Player::update(float dt) {